@@ -0,0 +1,354 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "fixed_point.h"
+
+/*
+ * Accuracy, regression and throughput suite for the fixed-point kernels.
+ *
+ * For every q in the range and every coefficient set, all 65536 int16 x
+ * values go through multiply_fixed, the a*x^2 - b*x + c path and the
+ * Horner path. Each result is compared with a double-precision reference
+ * (error in ulps, 1 ulp = 2^-q). Inputs where an intermediate leaves int16
+ * and wraps are counted separately and left out of the error figures.
+ *
+ * Each optimized path is also checked bit for bit against a plain 64-bit
+ * reimplementation of the original formulas, and every batch form against
+ * its scalar form. Any mismatch is reported and the exit status is 1, so
+ * changes to fixed_point.c can be checked for unchanged results.
+ *
+ * Build: gcc -O2 bench_fixed_point.c fixed_point.c -o bench_fixed_point -lm
+ * Run:   ./bench_fixed_point [q_min q_max] [repeats]
+ */
+
+#define SWEEP_N 65536
+
+/*
+ * Constant: BENCH_Q_MIN / BENCH_Q_MAX - Accepted q range. q up to 30 is
+ * supported by multiply_fixed, print_fixed and the Horner path, and q
+ * above 16 exercises the scalar fallbacks of the batch APIs.
+ */
+#define BENCH_Q_MIN 0
+#define BENCH_Q_MAX 30
+
+/*
+ * Struct: CoeffSet
+ * Real-valued coefficients, converted to raw for each q.
+ */
+typedef struct {
+    double a;
+    double b;
+    double c;
+} CoeffSet;
+
+/*
+ * Struct: ErrStats
+ * Error accumulator over one sweep.
+ */
+typedef struct {
+    double max_err;
+    double sum_err;
+    long counted;
+    long wraps;
+} ErrStats;
+
+static const CoeffSet coeff_sets[] = {
+    { 1.0,   0.5,  0.25 },
+    { 0.75, -1.25, 2.0  },
+    { -0.3,  0.1,  0.05 },
+    { 3.0,   2.0, -1.0  },
+};
+#define SET_COUNT (int)(sizeof(coeff_sets) / sizeof(coeff_sets[0]))
+
+// Functions
+static double now_seconds(void);
+static int16_t to_raw(double v, int q);
+static int fits_int16(int64_t v);
+static int16_t ref_multiply(int16_t a, int16_t b, int q, int *wrapped);
+static int16_t ref_poly(int16_t x, int16_t a, int16_t b, int16_t c, int q, int *wrapped);
+static void add_error(ErrStats *st, double got_raw, double want_raw, int wrapped);
+static long check_same(const char *what, const int16_t *got, const int16_t *want, int q);
+static long sweep(int q, const CoeffSet *set, int set_index);
+static void bench_speed(int q, int repeats);
+static void print_usage(const char *prog);
+
+static int16_t xs[SWEEP_N];
+static int16_t as[SWEEP_N], bs[SWEEP_N], cs[SWEEP_N];
+static int16_t out_scalar[SWEEP_N], out_batch[SWEEP_N];
+static volatile int16_t sink;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Nearest raw value for v in Q-format, clamped to int16.
+ */
+static int16_t to_raw(double v, int q) {
+    double r = nearbyint(v * (double)(1 << q));
+    if (r > 32767.0) r = 32767.0;
+    if (r < -32768.0) r = -32768.0;
+    return (int16_t)r;
+}
+
+static int fits_int16(int64_t v) {
+    return v >= INT16_MIN && v <= INT16_MAX;
+}
+
+/*
+ * The original multiply_fixed, also reporting whether the result wrapped.
+ */
+static int16_t ref_multiply(int16_t a, int16_t b, int q, int *wrapped) {
+    int64_t product = ((int64_t)a * (int64_t)b) >> q;
+    if (!fits_int16(product)) *wrapped = 1;
+    return (int16_t)product;
+}
+
+/*
+ * The original a*x^2 - b*x + c evaluation, step by step.
+ */
+static int16_t ref_poly(int16_t x, int16_t a, int16_t b, int16_t c, int q, int *wrapped) {
+    int16_t x_squared = ref_multiply(x, x, q, wrapped);
+    int16_t ax2 = ref_multiply(a, x_squared, q, wrapped);
+    int16_t bx = ref_multiply(b, x, q, wrapped);
+    int64_t diff = (int64_t)ax2 - bx;
+    if (!fits_int16(diff)) *wrapped = 1;
+    int64_t y = (int64_t)(int16_t)diff + c;
+    if (!fits_int16(y)) *wrapped = 1;
+    return (int16_t)y;
+}
+
+static void add_error(ErrStats *st, double got_raw, double want_raw, int wrapped) {
+    if (wrapped) {
+        st->wraps++;
+        return;
+    }
+    double err = fabs(got_raw - want_raw);
+    if (err > st->max_err) st->max_err = err;
+    st->sum_err += err;
+    st->counted++;
+}
+
+/*
+ * Returns: number of elements where 'got' differs from 'want'.
+ */
+static long check_same(const char *what, const int16_t *got, const int16_t *want, int q) {
+    long bad = 0;
+    for (int i = 0; i < SWEEP_N; i++) {
+        if (got[i] != want[i]) {
+            if (bad == 0) {
+                printf("  MISMATCH %s q=%d x=%d: got %d, want %d\n",
+                       what, q, xs[i], got[i], want[i]);
+            }
+            bad++;
+        }
+    }
+    return bad;
+}
+
+/*
+ * Accuracy and regression checks for one q and coefficient set.
+ * Returns: number of mismatches found.
+ */
+static long sweep(int q, const CoeffSet *set, int set_index) {
+    double scale = (double)(1 << q);
+    int16_t a = to_raw(set->a, q);
+    int16_t b = to_raw(set->b, q);
+    int16_t c = to_raw(set->c, q);
+    double ar = a / scale, br = b / scale, cr = c / scale;
+
+    ErrStats mul = {0}, poly = {0}, horner = {0};
+    long mul_bad = 0, poly_bad = 0, horner_bad = 0;
+
+    // Horner form of the same polynomial: c + (-b)*x + a*x^2
+    int16_t coeffs[3] = { c, (int16_t)-b, a };
+    int horner_wrap_b = !fits_int16(-(int32_t)b);
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        int16_t x = xs[i];
+        double xr = x / scale;
+        int wrapped = 0;
+
+        int16_t m = multiply_fixed(x, a, q);
+        int16_t m_want = ref_multiply(x, a, q, &wrapped);
+        if (m != m_want) {
+            if (mul_bad == 0) {
+                printf("  MISMATCH multiply vs original q=%d x=%d a=%d: got %d, want %d\n",
+                       q, x, a, m, m_want);
+            }
+            mul_bad++;
+        }
+        add_error(&mul, m, xr * ar * scale, wrapped);
+
+        wrapped = 0;
+        int16_t want = ref_poly(x, a, b, c, q, &wrapped);
+        out_scalar[i] = poly_ax2_minus_bx_plus_c_fixed(x, a, b, c, q);
+        if (out_scalar[i] != want) {
+            if (poly_bad == 0) {
+                printf("  MISMATCH poly vs original q=%d x=%d: got %d, want %d\n",
+                       q, x, out_scalar[i], want);
+            }
+            poly_bad++;
+        }
+        double exact = (ar * xr * xr - br * xr + cr) * scale;
+        add_error(&poly, out_scalar[i], exact, wrapped);
+
+        // Horner wraps whenever a partial sum leaves int16
+        wrapped = horner_wrap_b;
+        int16_t y = coeffs[2];
+        for (int k = 1; k >= 0; k--) {
+            int16_t t = ref_multiply(y, x, q, &wrapped);
+            int64_t s = (int64_t)t + coeffs[k];
+            if (!fits_int16(s)) wrapped = 1;
+            y = (int16_t)s;
+        }
+        int16_t h = eval_poly_horner_fixed(coeffs, 2, x, q);
+        if (h != y) {
+            if (horner_bad == 0) {
+                printf("  MISMATCH horner vs reference q=%d x=%d: got %d, want %d\n",
+                       q, x, h, y);
+            }
+            horner_bad++;
+        }
+        add_error(&horner, h, exact, wrapped);
+    }
+
+    long bad = mul_bad + poly_bad + horner_bad;
+
+    eval_poly_ax2_minus_bx_plus_c_batch(xs, a, b, c, q, out_batch, SWEEP_N);
+    bad += check_same("poly batch", out_batch, out_scalar, q);
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        as[i] = a;
+        bs[i] = b;
+        cs[i] = c;
+    }
+    eval_poly_ax2_minus_bx_plus_c_batch_tuples(xs, as, bs, cs, q, out_batch, SWEEP_N);
+    bad += check_same("poly batch_tuples", out_batch, out_scalar, q);
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        out_scalar[i] = multiply_fixed(xs[i], a, q);
+    }
+    multiply_fixed_batch(xs, as, q, out_batch, SWEEP_N);
+    bad += check_same("multiply batch", out_batch, out_scalar, q);
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        out_scalar[i] = eval_poly_horner_fixed(coeffs, 2, xs[i], q);
+    }
+    eval_poly_horner_fixed_batch(coeffs, 2, xs, q, out_batch, SWEEP_N);
+    bad += check_same("horner batch", out_batch, out_scalar, q);
+
+    printf("%3d %3d  %8.3f %9.4f %6ld   %8.3f %9.4f %6ld   %8.3f %9.4f %6ld\n",
+           q, set_index,
+           mul.max_err, mul.counted ? mul.sum_err / mul.counted : 0.0, mul.wraps,
+           poly.max_err, poly.counted ? poly.sum_err / poly.counted : 0.0, poly.wraps,
+           horner.max_err, horner.counted ? horner.sum_err / horner.counted : 0.0,
+           horner.wraps);
+
+    return bad;
+}
+
+/*
+ * Times the scalar and batch paths over the full x sweep, using the
+ * first coefficient set. Reports the best of 'repeats' runs.
+ */
+static void bench_speed(int q, int repeats) {
+    int16_t a = to_raw(coeff_sets[0].a, q);
+    int16_t b = to_raw(coeff_sets[0].b, q);
+    int16_t c = to_raw(coeff_sets[0].c, q);
+    int16_t coeffs[3] = { c, (int16_t)-b, a };
+    double best[6] = { 1e30, 1e30, 1e30, 1e30, 1e30, 1e30 };
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        as[i] = a;
+        bs[i] = b;
+        cs[i] = c;
+    }
+
+    for (int r = 0; r < repeats; r++) {
+        double t0 = now_seconds();
+        for (int i = 0; i < SWEEP_N; i++) out_scalar[i] = multiply_fixed(xs[i], a, q);
+        double t1 = now_seconds();
+        multiply_fixed_batch(xs, as, q, out_batch, SWEEP_N);
+        double t2 = now_seconds();
+        for (int i = 0; i < SWEEP_N; i++) {
+            out_scalar[i] = poly_ax2_minus_bx_plus_c_fixed(xs[i], a, b, c, q);
+        }
+        double t3 = now_seconds();
+        eval_poly_ax2_minus_bx_plus_c_batch(xs, a, b, c, q, out_batch, SWEEP_N);
+        double t4 = now_seconds();
+        for (int i = 0; i < SWEEP_N; i++) {
+            out_scalar[i] = eval_poly_horner_fixed(coeffs, 2, xs[i], q);
+        }
+        double t5 = now_seconds();
+        eval_poly_horner_fixed_batch(coeffs, 2, xs, q, out_batch, SWEEP_N);
+        double t6 = now_seconds();
+        sink = (int16_t)(out_scalar[r % SWEEP_N] ^ out_batch[r % SWEEP_N]);
+
+        double t[6] = { t1 - t0, t2 - t1, t3 - t2, t4 - t3, t5 - t4, t6 - t5 };
+        for (int k = 0; k < 6; k++) {
+            if (t[k] < best[k]) best[k] = t[k];
+        }
+    }
+
+    printf("%3d  %9.3f %9.3f  %9.3f %9.3f  %9.3f %9.3f\n", q,
+           best[0] * 1e9 / SWEEP_N, best[1] * 1e9 / SWEEP_N,
+           best[2] * 1e9 / SWEEP_N, best[3] * 1e9 / SWEEP_N,
+           best[4] * 1e9 / SWEEP_N, best[5] * 1e9 / SWEEP_N);
+}
+
+static void print_usage(const char *prog) {
+    printf("Usage: %s [q_min q_max] [repeats]\n", prog);
+    printf("q range must satisfy %d <= q_min <= q_max <= %d\n", BENCH_Q_MIN, BENCH_Q_MAX);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 1 && argc != 3 && argc != 4) {
+        print_usage(argv[0]);
+        return 0;
+    }
+
+    int q_min = (argc >= 3) ? atoi(argv[1]) : 4;
+    int q_max = (argc >= 3) ? atoi(argv[2]) : 15;
+    int repeats = (argc == 4) ? atoi(argv[3]) : 20;
+    if (repeats < 1) repeats = 1;
+
+    // An empty or out-of-range sweep must not report success
+    if (q_min < BENCH_Q_MIN || q_max > BENCH_Q_MAX || q_min > q_max) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    for (int i = 0; i < SWEEP_N; i++) {
+        xs[i] = (int16_t)(i - 32768);
+    }
+
+    printf("Accuracy vs double reference (error in ulps; wrapped inputs excluded and counted)\n");
+    printf("              multiply                     poly                       horner\n");
+    printf("  q set   max_err  mean_err  wraps    max_err  mean_err  wraps    max_err  mean_err  wraps\n");
+
+    long bad = 0;
+    for (int q = q_min; q <= q_max; q++) {
+        for (int s = 0; s < SET_COUNT; s++) {
+            bad += sweep(q, &coeff_sets[s], s);
+        }
+    }
+
+    printf("\nThroughput, ns per evaluation (best of %d sweeps of %d x values)\n", repeats, SWEEP_N);
+    printf("  q   mul_scal mul_batch  poly_scal poly_batc  horn_scal horn_batc\n");
+    for (int q = q_min; q <= q_max; q++) {
+        bench_speed(q, repeats);
+    }
+
+    if (bad) {
+        printf("\nFAILED: %ld results differ from the reference implementation\n", bad);
+        return 1;
+    }
+    printf("\nAll results match the reference implementation\n");
+    return 0;
+}
@@ -0,0 +1,186 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "org_tree.h"
+#include "org_search.h"
+#include "workload.h"
+
+/*
+ * Benchmark driver for ex1 cleaning, build_org_from_clean_file and the
+ * ex2 mask search, over generated workloads of growing size.
+ *
+ * ex1 and ex2 keep their logic inside main(), so they are timed end to end
+ * as child processes. build_org_from_clean_file is timed in-process, and so
+ * is the mask search: the org is built once and ex2's own search_masks
+ * (org_search.c) runs against it.
+ *
+ * Build: gcc -O2 bench_workload.c workload.c org_tree.c org_search.c -o bench_workload
+ * Run:   ./bench_workload ./ex1 ./ex2 [work_dir] [max_records]
+ */
+
+#define BENCH_START_RECORDS 1000
+#define BENCH_DEFAULT_MAX   16000
+#define BENCH_BUILD_REPEATS 5
+#define BENCH_MASK          200
+
+// Functions
+static double now_seconds(void);
+static long file_size(const char *path);
+static long count_records(const char *path);
+static double run_command(const char *cmd, char *first_line, size_t line_size);
+static void bench_ex1(const char *ex1, const char *dir, long records);
+static void bench_build_and_search(const char *ex2, const char *dir, long records);
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static long file_size(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return 0;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fclose(fp);
+    return size;
+}
+
+/*
+ * Counts "First Name:" lines in a clean file.
+ */
+static long count_records(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return 0;
+
+    char line[128];
+    long count = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        if (strstr(line, "First Name:") == line) count++;
+    }
+    fclose(fp);
+    return count;
+}
+
+/*
+ * Runs 'cmd' in a shell, keeps the first line of its output and returns
+ * the wall time in seconds (negative if the command could not be started).
+ */
+static double run_command(const char *cmd, char *first_line, size_t line_size) {
+    double start = now_seconds();
+    FILE *pipe = popen(cmd, "r");
+    if (!pipe) return -1.0;
+
+    char line[512];
+    if (first_line) first_line[0] = '\0';
+    while (fgets(line, sizeof(line), pipe)) {
+        if (first_line && first_line[0] == '\0') {
+            snprintf(first_line, line_size, "%s", line);
+        }
+    }
+    int status = pclose(pipe);
+    double elapsed = now_seconds() - start;
+
+    return (status == -1) ? -1.0 : elapsed;
+}
+
+static void bench_ex1(const char *ex1, const char *dir, long records) {
+    char in_path[512], out_path[512], cmd[1536];
+    snprintf(in_path, sizeof(in_path), "%s/corrupted_%ld.txt", dir, records);
+    snprintf(out_path, sizeof(out_path), "%s/clean_%ld.txt", dir, records);
+
+    // 5% corruption, 10% duplicated fingerprints
+    if (!gen_corrupted_file(in_path, records, 0.05, 0.10, 1)) return;
+
+    snprintf(cmd, sizeof(cmd), "\"%s\" \"%s\" \"%s\"", ex1, in_path, out_path);
+    double t = run_command(cmd, NULL, 0);
+    if (t < 0) {
+        printf("  ex1: failed to run %s\n", ex1);
+        return;
+    }
+
+    double mb = (double)file_size(in_path) / (1024.0 * 1024.0);
+    printf("  ex1 clean        %8ld records  %9.3f ms  %12.0f records/s  %8.2f MB/s  (kept %ld)\n",
+           records, t * 1e3, records / t, mb / t, count_records(out_path));
+}
+
+static void bench_build_and_search(const char *ex2, const char *dir, long records) {
+    char org_path[512], cipher_path[512], cmd[1536];
+    snprintf(org_path, sizeof(org_path), "%s/org_%ld.txt", dir, records);
+    snprintf(cipher_path, sizeof(cipher_path), "%s/cipher_%ld.txt", dir, records);
+
+    long supports = (records - 3) / 2;
+    long total = 3 + 2 * supports;
+    if (!gen_org_file(org_path, supports, 1)) return;
+    if (!gen_cipher_file(org_path, cipher_path, BENCH_MASK, 1)) return;
+
+    // In-process: best of several builds
+    double best = -1.0;
+    for (int r = 0; r < BENCH_BUILD_REPEATS; r++) {
+        double start = now_seconds();
+        Org org = build_org_from_clean_file(org_path);
+        double t = now_seconds() - start;
+        free_org(&org);
+        if (best < 0 || t < best) best = t;
+    }
+    printf("  build_org        %8ld records  %9.3f ms  %12.0f records/s\n",
+           total, best * 1e3, total / best);
+
+    // In-process search on one built org. The match sits on the last mask
+    // and the last node, so every earlier (mask, op) pair scans everything.
+    int cipher_vals[FP_LEN];
+    if (read_cipher_file(cipher_path, cipher_vals) != FP_LEN) {
+        printf("  mask search: could not read %s\n", cipher_path);
+        return;
+    }
+    Org org = build_org_from_clean_file(org_path);
+    Node *match = NULL;
+    int mask = 0, is_xor = 0;
+    best = -1.0;
+    for (int r = 0; r < BENCH_BUILD_REPEATS; r++) {
+        double start = now_seconds();
+        match = search_masks(&org, cipher_vals, BENCH_MASK - MASK_SPAN, &mask, &is_xor);
+        double t = now_seconds() - start;
+        if (best < 0 || t < best) best = t;
+    }
+    free_org(&org);
+
+    double checks = (double)(2 * MASK_SPAN + 1) * (double)total;
+    printf("  mask search      %8ld records  %9.3f ms  %12.0f checks/s    (%s)\n",
+           total, best * 1e3, checks / best, match ? "match" : "NO MATCH");
+
+    // ex2 end to end: process startup, file parsing, build and search
+    snprintf(cmd, sizeof(cmd), "\"%s\" \"%s\" \"%s\" %d",
+             ex2, org_path, cipher_path, BENCH_MASK - MASK_SPAN);
+    char first_line[512];
+    double t = run_command(cmd, first_line, sizeof(first_line));
+    if (t < 0) {
+        printf("  ex2: failed to run %s\n", ex2);
+        return;
+    }
+    printf("  ex2 end to end   %8ld records  %9.3f ms                      (%s)\n",
+           total, t * 1e3,
+           strstr(first_line, "Successful") == first_line ? "match" : "NO MATCH");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3 || argc > 5) {
+        printf("Usage: %s <ex1_binary> <ex2_binary> [work_dir] [max_records]\n", argv[0]);
+        return 0;
+    }
+
+    const char *ex1 = argv[1];
+    const char *ex2 = argv[2];
+    const char *dir = (argc >= 4) ? argv[3] : ".";
+    long max_records = (argc == 5) ? atol(argv[4]) : BENCH_DEFAULT_MAX;
+
+    for (long records = BENCH_START_RECORDS; records <= max_records; records *= 4) {
+        printf("size %ld\n", records);
+        bench_ex1(ex1, dir, records);
+        bench_build_and_search(ex2, dir, records);
+    }
+
+    return 0;
+}
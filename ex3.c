@@ -1,13 +1,323 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "fixed_point.h"
 
+/*
+ * Constant: BLOCK_TUPLES - Tuples read, evaluated and written per round
+ * in stream mode. Bounds memory use regardless of input size.
+ */
+#define BLOCK_TUPLES (1 << 18)
+
+/*
+ * Constant: MAX_THREADS - Upper bound on worker threads in stream mode.
+ */
+#define MAX_THREADS 64
+
+/*
+ * Struct: Block
+ * One round of input tuples, stored as separate arrays so they can be
+ * handed directly to the batch kernels.
+ */
+typedef struct {
+    int16_t x[BLOCK_TUPLES];
+    int16_t a[BLOCK_TUPLES];
+    int16_t b[BLOCK_TUPLES];
+    int16_t c[BLOCK_TUPLES];
+    int16_t q[BLOCK_TUPLES];
+    int16_t y[BLOCK_TUPLES];
+    size_t count;
+} Block;
+
+/*
+ * Struct: OutBuf
+ * Growable output buffer. Each worker formats its lines into its own
+ * buffer; buffers are written out in input order with one fwrite each.
+ */
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+    int failed;
+} OutBuf;
+
+/*
+ * Struct: Worker
+ * The slice [begin, end) of a block handled by one thread.
+ */
+typedef struct {
+    Block *block;
+    size_t begin;
+    size_t end;
+    OutBuf out;
+} Worker;
+
+// Functions
+static int outbuf_reserve(OutBuf *buf, size_t extra);
+static void *process_range(void *arg);
+static long read_text_block(FILE *in, Block *block, long *line_no, int *bad);
+static long read_binary_block(FILE *in, Block *block, int *bad);
+static int run_stream(FILE *in, int binary, int threads);
+static void print_usage(const char *prog);
+
+
+/*
+ * Makes room for at least 'extra' more bytes.
+ * Returns: 1 on success, 0 if memory could not be allocated.
+ */
+static int outbuf_reserve(OutBuf *buf, size_t extra) {
+    if (buf->len + extra <= buf->cap) return 1;
+
+    size_t cap = buf->cap ? buf->cap : 4096;
+    while (cap < buf->len + extra) cap *= 2;
+
+    char *data = realloc(buf->data, cap);
+    if (!data) {
+        buf->failed = 1;
+        return 0;
+    }
+    buf->data = data;
+    buf->cap = cap;
+    return 1;
+}
+
+/*
+ * Thread body: evaluates a slice of the block with the batch kernel
+ * (one call per run of equal q) and formats the result lines.
+ */
+static void *process_range(void *arg) {
+    Worker *w = (Worker *)arg;
+    Block *blk = w->block;
+
+    size_t i = w->begin;
+    while (i < w->end) {
+        size_t run_end = i + 1;
+        while (run_end < w->end && blk->q[run_end] == blk->q[i]) run_end++;
+
+        eval_poly_ax2_minus_bx_plus_c_batch_tuples(blk->x + i, blk->a + i, blk->b + i,
+                                                   blk->c + i, blk->q[i], blk->y + i,
+                                                   run_end - i);
+        i = run_end;
+    }
+
+    for (i = w->begin; i < w->end; i++) {
+        if (!outbuf_reserve(&w->out, FIXED_LINE_MAX)) break;
+        w->out.len += format_poly_line(w->out.data + w->out.len, blk->a[i], blk->b[i],
+                                       blk->c[i], blk->y[i], blk->q[i]);
+    }
+
+    return NULL;
+}
+
+/*
+ * Reads up to BLOCK_TUPLES lines of "x a b c q". Blank lines are skipped.
+ * Stops at a malformed line and sets *bad; *line_no is then that line.
+ * Returns: number of valid tuples read before stopping.
+ */
+static long read_text_block(FILE *in, Block *block, long *line_no, int *bad) {
+    char line[256];
+    block->count = 0;
+    *bad = 0;
+
+    while (block->count < BLOCK_TUPLES && fgets(line, sizeof(line), in)) {
+        (*line_no)++;
+
+        long vals[5];
+        char *cursor = line;
+        int n = 0;
+        for (; n < 5; n++) {
+            char *end;
+            vals[n] = strtol(cursor, &end, 10);
+            if (end == cursor) break;
+            cursor = end;
+        }
+
+        if (n == 0 && strspn(line, " \t\r\n") == strlen(line)) continue;
+        if (n != 5 || strspn(cursor, " \t\r\n") != strlen(cursor)) {
+            *bad = 1;
+            break;
+        }
+
+        size_t k = block->count++;
+        block->x[k] = (int16_t)vals[0];
+        block->a[k] = (int16_t)vals[1];
+        block->b[k] = (int16_t)vals[2];
+        block->c[k] = (int16_t)vals[3];
+        block->q[k] = (int16_t)vals[4];
+    }
+
+    return (long)block->count;
+}
+
+/*
+ * Reads up to BLOCK_TUPLES packed tuples: five little-endian int16 values
+ * (x, a, b, c, q) per tuple. Sets *bad if the input ends mid-tuple.
+ * Returns: number of complete tuples read.
+ */
+static long read_binary_block(FILE *in, Block *block, int *bad) {
+    unsigned char raw[10 * 1024];
+    block->count = 0;
+    *bad = 0;
+
+    while (block->count < BLOCK_TUPLES) {
+        size_t want = BLOCK_TUPLES - block->count;
+        if (want > sizeof(raw) / 10) want = sizeof(raw) / 10;
+
+        size_t got = fread(raw, 1, want * 10, in);
+        if (got % 10 != 0) *bad = 1;
+
+        for (size_t t = 0; t < got / 10; t++) {
+            const unsigned char *p = raw + t * 10;
+            size_t k = block->count++;
+            block->x[k] = (int16_t)(p[0] | (p[1] << 8));
+            block->a[k] = (int16_t)(p[2] | (p[3] << 8));
+            block->b[k] = (int16_t)(p[4] | (p[5] << 8));
+            block->c[k] = (int16_t)(p[6] | (p[7] << 8));
+            block->q[k] = (int16_t)(p[8] | (p[9] << 8));
+        }
+
+        if (got < want * 10) break;
+    }
+
+    return (long)block->count;
+}
+
+/*
+ * Streams tuples from 'in' to stdout, one block at a time. Each block is
+ * split across 'threads' workers and their output is written in order.
+ * Returns: 0 on success, 1 on malformed input or allocation failure.
+ */
+static int run_stream(FILE *in, int binary, int threads) {
+    Block *block = malloc(sizeof(Block));
+    if (!block) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return 1;
+    }
+
+    Worker workers[MAX_THREADS];
+    pthread_t tids[MAX_THREADS];
+    int started[MAX_THREADS];
+    memset(workers, 0, sizeof(workers));
+
+    long line_no = 0;
+    int status = 0;
+    int bad = 0;
+
+    while (1) {
+        long n = binary ? read_binary_block(in, block, &bad)
+                        : read_text_block(in, block, &line_no, &bad);
+        if (n == 0) break;
+
+        // Small blocks are not worth a thread each
+        int used = threads;
+        if ((long)used > n / 1024 + 1) used = (int)(n / 1024 + 1);
+
+        size_t per = (size_t)n / used;
+        size_t extra = (size_t)n % used;
+        size_t begin = 0;
+        for (int t = 0; t < used; t++) {
+            workers[t].block = block;
+            workers[t].begin = begin;
+            workers[t].end = begin + per + ((size_t)t < extra ? 1 : 0);
+            workers[t].out.len = 0;
+            begin = workers[t].end;
+        }
+
+        for (int t = 1; t < used; t++) {
+            started[t] = (pthread_create(&tids[t], NULL, process_range, &workers[t]) == 0);
+            if (!started[t]) {
+                // Could not start it: do the slice on this thread instead
+                process_range(&workers[t]);
+            }
+        }
+        process_range(&workers[0]);
+
+        // Join everything before touching the buffers
+        for (int t = 1; t < used; t++) {
+            if (started[t]) pthread_join(tids[t], NULL);
+        }
+
+        for (int t = 0; t < used; t++) {
+            if (workers[t].out.failed) {
+                fprintf(stderr, "Memory allocation failed\n");
+                status = 1;
+                break;
+            }
+            fwrite(workers[t].out.data, 1, workers[t].out.len, stdout);
+        }
+        if (status) break;
+
+        // Tuples before a bad line or truncated tail are written first
+        if (bad || (size_t)n < BLOCK_TUPLES) break;
+    }
+
+    fflush(stdout);
+    if (bad && !status) {
+        if (binary) fprintf(stderr, "Truncated tuple at end of binary input\n");
+        else fprintf(stderr, "Invalid input on line %ld\n", line_no);
+        status = 1;
+    }
+
+    for (int t = 0; t < MAX_THREADS; t++) {
+        free(workers[t].out.data);
+    }
+    free(block);
+    return status;
+}
+
+static void print_usage(const char *prog) {
+    printf("Usage: %s <x_raw> <a_raw> <b_raw> <c_raw> <q>\n", prog);
+    printf("       %s --stream [--binary] [--threads N] [input_file|-]\n", prog);
+    printf("All inputs must be integers. (x/a/b/c/q are int16 raw fixed-point values)\n");
+    printf("Stream mode reads \"x a b c q\" per line, or with --binary packed little-endian\n");
+    printf("int16 tuples, from the file or stdin and prints one result per tuple in input order.\n");
+}
 
 int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "--stream") == 0) {
+        int binary = 0;
+        long threads = sysconf(_SC_NPROCESSORS_ONLN);
+        const char *path = NULL;
+
+        for (int i = 2; i < argc; i++) {
+            if (strcmp(argv[i], "--binary") == 0) {
+                binary = 1;
+            } else if (strcmp(argv[i], "--threads") == 0) {
+                if (i + 1 >= argc) {
+                    print_usage(argv[0]);
+                    return 0;
+                }
+                threads = atol(argv[++i]);
+            } else if (!path) {
+                path = argv[i];
+            } else {
+                print_usage(argv[0]);
+                return 0;
+            }
+        }
+        if (threads < 1) threads = 1;
+        if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+        FILE *in = stdin;
+        if (path && strcmp(path, "-") != 0) {
+            in = fopen(path, binary ? "rb" : "r");
+            if (!in) {
+                printf("Error opening file: %s\n", path);
+                return 0;
+            }
+        }
+
+        int status = run_stream(in, binary, (int)threads);
+        if (in != stdin) fclose(in);
+        return status;
+    }
+
     if (argc != 6) {
-        printf("Usage: %s <x_raw> <a_raw> <b_raw> <c_raw> <q>\n", argv[0]);
-        printf("All inputs must be integers. (x/a/b/c/q are int16 raw fixed-point values)\n");
+        print_usage(argv[0]);
         return 0;
     }
 
@@ -17,8 +327,8 @@ int main(int argc, char **argv) {
     int16_t c_raw = (int16_t)atoi(argv[4]);
     int16_t q_raw = (int16_t)atoi(argv[5]);
 
-    
+
     eval_poly_ax2_minus_bx_plus_c_fixed(x_raw, a_raw, b_raw, c_raw, q_raw);
-    
+
     return 0;
-}
\ No newline at end of file
+}
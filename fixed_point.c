@@ -2,21 +2,121 @@
 #include <stdio.h>
 #include <stdint.h>
 
-void print_fixed(int16_t raw, int16_t q) {
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FIXED_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FIXED_SIMD_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FIXED_SIMD_NEON 1
+#endif
+
+/* Widest q the SIMD multiply-high kernels reproduce exactly. */
+#define FIXED_SIMD_MAX_Q 16
+
+#if defined(__GNUC__)
+#define FIXED_ALWAYS_INLINE static inline __attribute__((always_inline))
+#else
+#define FIXED_ALWAYS_INLINE static inline
+#endif
+
+/* Highest degree + 1 whose broadcast coefficients the SIMD Horner kernel
+ * keeps in registers; higher degrees use the scalar kernel. */
+#define FIXED_HORNER_MAX_SPLAT 16
+
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/*
+ * Writes v in decimal like printf("%d") and returns the length.
+ */
+static int format_int(char *buf, int v) {
+    char tmp[12];
+    int pos = sizeof(tmp);
+    unsigned int u = (v < 0) ? 0u - (unsigned int)v : (unsigned int)v;
+
+    while (u >= 100) {
+        unsigned int pair = (u % 100) * 2;
+        u /= 100;
+        tmp[--pos] = digit_pairs[pair + 1];
+        tmp[--pos] = digit_pairs[pair];
+    }
+    if (u >= 10) {
+        tmp[--pos] = digit_pairs[u * 2 + 1];
+        tmp[--pos] = digit_pairs[u * 2];
+    } else {
+        tmp[--pos] = (char)('0' + u);
+    }
+    if (v < 0) tmp[--pos] = '-';
+
+    int len = (int)sizeof(tmp) - pos;
+    for (int i = 0; i < len; i++) {
+        buf[i] = tmp[pos + i];
+    }
+    return len;
+}
+
+static int append_str(char *buf, const char *s) {
+    int len = 0;
+    while (s[len]) {
+        buf[len] = s[len];
+        len++;
+    }
+    return len;
+}
+
+int format_fixed(char *buf, int16_t raw, int16_t q) {
 
     int16_t integer_part = raw >> q;
-    
+
     int16_t mask = (1 << q) - 1;
     int16_t fraction = raw & mask;
 
-    printf("%d.", integer_part);
+    int len = format_int(buf, integer_part);
+    buf[len++] = '.';
 
     for (int i = 0; i < 6; i++) {
         int temp = fraction * 10;
         int digit = temp >> q;
-        printf("%d", digit);
+        // Only q >= 16 can produce a digit outside 0..9
+        if (digit >= 0 && digit <= 9) buf[len++] = (char)('0' + digit);
+        else len += format_int(buf + len, digit);
         fraction = temp & mask;
     }
+
+    buf[len] = '\0';
+    return len;
+}
+
+int format_poly_line(char *buf, int16_t a, int16_t b, int16_t c, int16_t y, int16_t q) {
+    int len = append_str(buf, "the polynomial output for a=");
+    len += format_fixed(buf + len, a, q);
+    len += append_str(buf + len, ", b=");
+    len += format_fixed(buf + len, b, q);
+    len += append_str(buf + len, ", c=");
+    len += format_fixed(buf + len, c, q);
+    len += append_str(buf + len, " is ");
+    len += format_fixed(buf + len, y, q);
+    buf[len++] = '\n';
+    buf[len] = '\0';
+    return len;
+}
+
+void print_fixed(int16_t raw, int16_t q) {
+    char buf[FIXED_FMT_MAX];
+    int len = format_fixed(buf, raw, q);
+    fwrite(buf, 1, (size_t)len, stdout);
 }
 
 int16_t add_fixed(int16_t a, int16_t b) {
@@ -32,20 +132,451 @@ int16_t multiply_fixed(int16_t a, int16_t b, int16_t q) {
     return (int16_t)(product >> q);
 }
 
-void eval_poly_ax2_minus_bx_plus_c_fixed(int16_t x, int16_t a, int16_t b, int16_t c, int16_t q) {
+int16_t poly_ax2_minus_bx_plus_c_fixed(int16_t x, int16_t a, int16_t b, int16_t c, int16_t q) {
     int16_t x_squared = multiply_fixed(x, x, q);
     int16_t ax2 = multiply_fixed(a, x_squared, q);
     int16_t bx = multiply_fixed(b, x, q);
     int16_t term_diff = subtract_fixed(ax2, bx);
-    int16_t y = add_fixed(term_diff, c);
-    
-    printf("the polynomial output for a=");
-    print_fixed(a, q);
-    printf(", b=");
-    print_fixed(b, q);
-    printf(", c=");
-    print_fixed(c, q);
-    printf(" is ");
-    print_fixed(y, q);
-    printf("\n");
-}
\ No newline at end of file
+    return add_fixed(term_diff, c);
+}
+
+void eval_poly_ax2_minus_bx_plus_c_fixed(int16_t x, int16_t a, int16_t b, int16_t c, int16_t q) {
+    int16_t y = poly_ax2_minus_bx_plus_c_fixed(x, a, b, c, q);
+
+    char line[FIXED_LINE_MAX];
+    int len = format_poly_line(line, a, b, c, y, q);
+    fwrite(line, 1, (size_t)len, stdout);
+}
+
+/*
+ * SIMD multiply kernels.
+ *
+ * multiply_fixed keeps the low 16 bits of (a*b)>>q. The 32-bit product is
+ * split into its high and low halves (mulhi / mullo), so for 0 <= q <= 16
+ * the result is (hi << (16-q)) | (lo >>> q). NEON widens to 32 bits
+ * instead and narrows after an arithmetic shift.
+ */
+#if defined(FIXED_SIMD_AVX2)
+
+#define FIXED_LANES 16
+typedef __m256i fixed_vec;
+
+static inline fixed_vec vec_load(const int16_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static inline void vec_store(int16_t *p, fixed_vec v) { _mm256_storeu_si256((__m256i *)p, v); }
+static inline fixed_vec vec_splat(int16_t v) { return _mm256_set1_epi16(v); }
+static inline fixed_vec vec_add(fixed_vec a, fixed_vec b) { return _mm256_add_epi16(a, b); }
+static inline fixed_vec vec_sub(fixed_vec a, fixed_vec b) { return _mm256_sub_epi16(a, b); }
+
+static inline fixed_vec vec_mul(fixed_vec a, fixed_vec b, int16_t q) {
+    __m128i lshift = _mm_cvtsi32_si128(16 - q);
+    __m128i rshift = _mm_cvtsi32_si128(q);
+    __m256i hi = _mm256_mulhi_epi16(a, b);
+    __m256i lo = _mm256_mullo_epi16(a, b);
+    return _mm256_or_si256(_mm256_sll_epi16(hi, lshift), _mm256_srl_epi16(lo, rshift));
+}
+
+#elif defined(FIXED_SIMD_SSE2)
+
+#define FIXED_LANES 8
+typedef __m128i fixed_vec;
+
+static inline fixed_vec vec_load(const int16_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline void vec_store(int16_t *p, fixed_vec v) { _mm_storeu_si128((__m128i *)p, v); }
+static inline fixed_vec vec_splat(int16_t v) { return _mm_set1_epi16(v); }
+static inline fixed_vec vec_add(fixed_vec a, fixed_vec b) { return _mm_add_epi16(a, b); }
+static inline fixed_vec vec_sub(fixed_vec a, fixed_vec b) { return _mm_sub_epi16(a, b); }
+
+static inline fixed_vec vec_mul(fixed_vec a, fixed_vec b, int16_t q) {
+    __m128i lshift = _mm_cvtsi32_si128(16 - q);
+    __m128i rshift = _mm_cvtsi32_si128(q);
+    __m128i hi = _mm_mulhi_epi16(a, b);
+    __m128i lo = _mm_mullo_epi16(a, b);
+    return _mm_or_si128(_mm_sll_epi16(hi, lshift), _mm_srl_epi16(lo, rshift));
+}
+
+#elif defined(FIXED_SIMD_NEON)
+
+#define FIXED_LANES 8
+typedef int16x8_t fixed_vec;
+
+static inline fixed_vec vec_load(const int16_t *p) { return vld1q_s16(p); }
+static inline void vec_store(int16_t *p, fixed_vec v) { vst1q_s16(p, v); }
+static inline fixed_vec vec_splat(int16_t v) { return vdupq_n_s16(v); }
+static inline fixed_vec vec_add(fixed_vec a, fixed_vec b) { return vaddq_s16(a, b); }
+static inline fixed_vec vec_sub(fixed_vec a, fixed_vec b) { return vsubq_s16(a, b); }
+
+static inline fixed_vec vec_mul(fixed_vec a, fixed_vec b, int16_t q) {
+    int32x4_t shift = vdupq_n_s32(-q);
+    int32x4_t lo = vshlq_s32(vmull_s16(vget_low_s16(a), vget_low_s16(b)), shift);
+    int32x4_t hi = vshlq_s32(vmull_s16(vget_high_s16(a), vget_high_s16(b)), shift);
+    return vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+}
+
+#endif
+
+#if defined(FIXED_LANES)
+static inline fixed_vec vec_poly(fixed_vec x, fixed_vec a, fixed_vec b, fixed_vec c, int16_t q) {
+    fixed_vec x_squared = vec_mul(x, x, q);
+    fixed_vec ax2 = vec_mul(a, x_squared, q);
+    fixed_vec bx = vec_mul(b, x, q);
+    return vec_add(vec_sub(ax2, bx), c);
+}
+#endif
+
+void multiply_fixed_batch(const int16_t *a, const int16_t *b, int16_t q,
+                          int16_t *out, size_t n) {
+    size_t i = 0;
+#if defined(FIXED_LANES)
+    if (q >= 0 && q <= FIXED_SIMD_MAX_Q) {
+        for (; i + FIXED_LANES <= n; i += FIXED_LANES) {
+            vec_store(out + i, vec_mul(vec_load(a + i), vec_load(b + i), q));
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = multiply_fixed(a[i], b[i], q);
+    }
+}
+
+void eval_poly_ax2_minus_bx_plus_c_batch(const int16_t *x, int16_t a, int16_t b, int16_t c,
+                                         int16_t q, int16_t *out, size_t n) {
+    size_t i = 0;
+#if defined(FIXED_LANES)
+    if (q >= 0 && q <= FIXED_SIMD_MAX_Q) {
+        fixed_vec va = vec_splat(a);
+        fixed_vec vb = vec_splat(b);
+        fixed_vec vc = vec_splat(c);
+        for (; i + FIXED_LANES <= n; i += FIXED_LANES) {
+            vec_store(out + i, vec_poly(vec_load(x + i), va, vb, vc, q));
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = poly_ax2_minus_bx_plus_c_fixed(x[i], a, b, c, q);
+    }
+}
+
+void eval_poly_ax2_minus_bx_plus_c_batch_tuples(const int16_t *x, const int16_t *a,
+                                                const int16_t *b, const int16_t *c,
+                                                int16_t q, int16_t *out, size_t n) {
+    size_t i = 0;
+#if defined(FIXED_LANES)
+    if (q >= 0 && q <= FIXED_SIMD_MAX_Q) {
+        for (; i + FIXED_LANES <= n; i += FIXED_LANES) {
+            vec_store(out + i, vec_poly(vec_load(x + i), vec_load(a + i),
+                                        vec_load(b + i), vec_load(c + i), q));
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = poly_ax2_minus_bx_plus_c_fixed(x[i], a[i], b[i], c[i], q);
+    }
+}
+
+/*
+ * Horner kernels. They are written once with q as a parameter and forced
+ * inline into one wrapper per entry of FIXED_HORNER_QS, where q is a
+ * literal and the compiler emits immediate shift counts. On x86 a shift by
+ * a register count costs the same, and timings of the specialized q values
+ * sit within noise of their neighbours; the gain over multiply_fixed comes
+ * from the 32-bit product and from inlining, which the generic batch path
+ * shares. The 32-bit product is exact for int16 inputs, so (p >> q)
+ * truncated to int16 matches multiply_fixed's 64-bit version for q < 32.
+ */
+FIXED_ALWAYS_INLINE int16_t horner_kernel(const int16_t *coeffs, int degree,
+                                          int16_t x, int q) {
+    int16_t y = coeffs[degree];
+    for (int k = degree - 1; k >= 0; k--) {
+        y = (int16_t)((int16_t)(((int32_t)y * x) >> q) + coeffs[k]);
+    }
+    return y;
+}
+
+FIXED_ALWAYS_INLINE void horner_batch_kernel(const int16_t *coeffs, int degree,
+                                             const int16_t *x, int q,
+                                             int16_t *out, size_t n) {
+    size_t i = 0;
+#if defined(FIXED_LANES)
+    if (q >= 0 && q <= FIXED_SIMD_MAX_Q && degree < FIXED_HORNER_MAX_SPLAT) {
+        // Broadcast the coefficients once, not once per block of lanes
+        fixed_vec vc[FIXED_HORNER_MAX_SPLAT];
+        for (int k = 0; k <= degree; k++) {
+            vc[k] = vec_splat(coeffs[k]);
+        }
+        for (; i + FIXED_LANES <= n; i += FIXED_LANES) {
+            fixed_vec vx = vec_load(x + i);
+            fixed_vec y = vc[degree];
+            for (int k = degree - 1; k >= 0; k--) {
+                y = vec_add(vec_mul(y, vx, (int16_t)q), vc[k]);
+            }
+            vec_store(out + i, y);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = horner_kernel(coeffs, degree, x[i], q);
+    }
+}
+
+#define DEFINE_HORNER_Q(Q)                                                          \
+    static int16_t horner_q##Q(const int16_t *coeffs, int degree, int16_t x) {      \
+        return horner_kernel(coeffs, degree, x, Q);                                 \
+    }                                                                               \
+    static void horner_batch_q##Q(const int16_t *coeffs, int degree,                \
+                                  const int16_t *x, int16_t *out, size_t n) {       \
+        horner_batch_kernel(coeffs, degree, x, Q, out, n);                          \
+    }
+
+FIXED_HORNER_QS(DEFINE_HORNER_Q)
+
+/*
+ * Generic path for q outside FIXED_HORNER_QS, using multiply_fixed so q
+ * outside [0, 31] keeps the scalar semantics.
+ */
+static int16_t horner_generic(const int16_t *coeffs, int degree, int16_t x, int16_t q) {
+    int16_t y = coeffs[degree];
+    for (int k = degree - 1; k >= 0; k--) {
+        y = add_fixed(multiply_fixed(y, x, q), coeffs[k]);
+    }
+    return y;
+}
+
+int16_t eval_poly_horner_fixed(const int16_t *coeffs, int degree, int16_t x, int16_t q) {
+    if (!coeffs || degree < 0) return 0;
+
+#define HORNER_CASE(Q) case Q: return horner_q##Q(coeffs, degree, x);
+    switch (q) {
+        FIXED_HORNER_QS(HORNER_CASE)
+    default:
+        return horner_generic(coeffs, degree, x, q);
+    }
+#undef HORNER_CASE
+}
+
+void eval_poly_horner_fixed_batch(const int16_t *coeffs, int degree, const int16_t *x,
+                                  int16_t q, int16_t *out, size_t n) {
+    if (!coeffs || degree < 0) {
+        for (size_t i = 0; i < n; i++) out[i] = 0;
+        return;
+    }
+
+#define HORNER_BATCH_CASE(Q) case Q: horner_batch_q##Q(coeffs, degree, x, out, n); return;
+    switch (q) {
+        FIXED_HORNER_QS(HORNER_BATCH_CASE)
+    default:
+        break;
+    }
+#undef HORNER_BATCH_CASE
+
+    if (q >= 0 && q < 32) {
+        horner_batch_kernel(coeffs, degree, x, q, out, n);
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = horner_generic(coeffs, degree, x[i], q);
+        }
+    }
+}
+
+/*
+ * Division and square root.
+ *
+ * Reciprocal: a divisor d in [1, 2^15] is normalized to m = d << s in
+ * [2^15, 2^16). The table holds 2^46 / m at the midpoint of each of 64
+ * intervals (relative error under 2^-8); two Newton-Raphson steps
+ * y += y * (2^46 - m*y) / 2^46 bring that to about 2^-29. The quotient
+ * estimate (n * y) >> (46 - s) is then off by a few units at most, and a
+ * remainder check moves it to the exact floor.
+ *
+ * Square root: a separate 48-entry table seeds two Newton steps
+ * y = (y + n/y) / 2, and a final check settles the exact floor.
+ *
+ * Every result is therefore exact before saturation: the error is below
+ * 1 ulp (2^-q), toward zero for the quotients and downward for sqrt.
+ */
+static const uint32_t recip_table[64] = {
+    2130836488U, 2098304633U, 2066751180U, 2036132644U,
+    2006408080U, 1977538899U, 1949488702U, 1922223125U,
+    1895709703U, 1869917734U, 1844818167U, 1820383490U,
+    1796587627U, 1773405851U, 1750814694U, 1728791868U,
+    1707316192U, 1686367527U, 1665926709U, 1645975491U,
+    1626496491U, 1607473140U, 1588889636U, 1570730897U,
+    1552982525U, 1535630765U, 1518662469U, 1502065065U,
+    1485826524U, 1469935331U, 1454380460U, 1439151345U,
+    1424237860U, 1409630292U, 1395319325U, 1381296015U,
+    1367551776U, 1354078359U, 1340867839U, 1327912594U,
+    1315205296U, 1302738895U, 1290506605U, 1278501893U,
+    1266718465U, 1255150260U, 1243791434U, 1232636354U,
+    1221679586U, 1210915890U, 1200340205U, 1189947649U,
+    1179733506U, 1169693221U, 1159822392U, 1150116765U,
+    1140572228U, 1131184802U, 1121950641U, 1112866020U,
+    1103927337U, 1095131103U, 1086473940U, 1077952576U,
+};
+
+/*
+ * sqrt((i + 16.5) * 2^26) for i in [0, 48): square roots of the midpoints
+ * of the 48 intervals covering a value normalized to [2^30, 2^32).
+ */
+static const uint16_t sqrt_table[48] = {
+    33276, 34270, 35235, 36175, 37091, 37985, 38858, 39712,
+    40548, 41368, 42171, 42959, 43733, 44494, 45242, 45977,
+    46702, 47415, 48117, 48809, 49492, 50166, 50830, 51486,
+    52134, 52773, 53405, 54030, 54647, 55258, 55862, 56459,
+    57051, 57636, 58215, 58789, 59357, 59919, 60477, 61029,
+    61576, 62119, 62657, 63190, 63719, 64243, 64763, 65279,
+};
+
+/*
+ * Struct: Recip
+ * Refined reciprocal of one divisor, reusable across many dividends.
+ */
+typedef struct {
+    uint32_t d;     // divisor magnitude, 1..2^15
+    int shift;      // s, with d << s in [2^15, 2^16)
+    int64_t y;      // ~2^46 / (d << s)
+} Recip;
+
+static void recip_setup(Recip *r, uint32_t d) {
+    uint32_t m = d;
+    int s = 0;
+    while (m < 0x8000U) {
+        m <<= 1;
+        s++;
+    }
+
+    int64_t y = recip_table[(m >> 9) & 63];
+    for (int i = 0; i < 2; i++) {
+        int64_t e = ((int64_t)1 << 46) - (int64_t)m * y;
+        y += (y * (e >> 16)) >> 30;
+    }
+
+    r->d = d;
+    r->shift = s;
+    r->y = y;
+}
+
+/*
+ * floor(n / d) for n <= 2^32, using the precomputed reciprocal of d.
+ * y is up to 2^31, so a larger n would overflow n * y.
+ */
+static uint64_t recip_divide(const Recip *r, uint64_t n) {
+    int64_t quot = (int64_t)((n * (uint64_t)r->y) >> (46 - r->shift));
+    int64_t rem = (int64_t)n - quot * (int64_t)r->d;
+
+    while (rem < 0) {
+        quot--;
+        rem += r->d;
+    }
+    while (rem >= (int64_t)r->d) {
+        quot++;
+        rem -= r->d;
+    }
+    return (uint64_t)quot;
+}
+
+/*
+ * Applies the sign and saturates a quotient magnitude to int16.
+ */
+static int16_t saturate_signed(uint64_t mag, int negative) {
+    if (negative) return (mag >= 32768U) ? INT16_MIN : (int16_t)(-(int32_t)mag);
+    return (mag >= 32767U) ? INT16_MAX : (int16_t)mag;
+}
+
+/*
+ * Division by zero: saturate toward the sign of the dividend.
+ */
+static int16_t divide_by_zero(int32_t num) {
+    if (num > 0) return INT16_MAX;
+    if (num < 0) return INT16_MIN;
+    return 0;
+}
+
+static int16_t divide_with(const Recip *r, int16_t a, int negative_divisor, int16_t q) {
+    uint32_t mag = (a < 0) ? (uint32_t)(-(int32_t)a) : (uint32_t)a;
+    uint64_t quot = recip_divide(r, (uint64_t)mag << q);
+    return saturate_signed(quot, (a < 0) != negative_divisor);
+}
+
+int16_t divide_fixed(int16_t a, int16_t b, int16_t q) {
+    if (q < 0 || q > FIXED_DIV_MAX_Q) return 0;
+    if (b == 0) return divide_by_zero(a);
+
+    Recip r = {0};
+    recip_setup(&r, (b < 0) ? (uint32_t)(-(int32_t)b) : (uint32_t)b);
+    return divide_with(&r, a, b < 0, q);
+}
+
+int16_t reciprocal_fixed(int16_t x, int16_t q) {
+    if (q < 0 || q > FIXED_DIV_MAX_Q) return 0;
+    if (x == 0) return INT16_MAX;
+
+    Recip r = {0};
+    recip_setup(&r, (x < 0) ? (uint32_t)(-(int32_t)x) : (uint32_t)x);
+    return saturate_signed(recip_divide(&r, (uint64_t)1 << (2 * q)), x < 0);
+}
+
+/*
+ * floor(sqrt(n)) for 0 < n < 2^32: the table gives a first guess from the
+ * normalized top bits, two Newton steps y = (y + n/y) / 2 refine it and
+ * the final loops settle the last unit.
+ */
+static uint32_t isqrt_u32(uint32_t n) {
+    uint32_t norm = n;
+    int k = 0;
+    while (norm < 0x40000000U) {
+        norm <<= 2;
+        k++;
+    }
+
+    uint64_t y = sqrt_table[(norm >> 26) - 16] >> k;
+    if (y == 0) y = 1;
+    for (int i = 0; i < 2; i++) {
+        y = (y + n / y) >> 1;
+    }
+
+    while (y * y > n) y--;
+    while ((y + 1) * (y + 1) <= n) y++;
+    return (uint32_t)y;
+}
+
+int16_t sqrt_fixed(int16_t x, int16_t q) {
+    if (q < 0 || q > FIXED_DIV_MAX_Q) return 0;
+    if (x <= 0) return 0;
+
+    uint32_t root = isqrt_u32((uint32_t)x << q);
+    return (root > 32767U) ? INT16_MAX : (int16_t)root;
+}
+
+void divide_fixed_batch(const int16_t *a, const int16_t *b, int16_t q,
+                        int16_t *out, size_t n) {
+    if (q < 0 || q > FIXED_DIV_MAX_Q) {
+        for (size_t i = 0; i < n; i++) out[i] = 0;
+        return;
+    }
+
+    Recip r = {0};
+    int16_t cached = 0; // 0 is never cached: it has no reciprocal
+    for (size_t i = 0; i < n; i++) {
+        int16_t d = b[i];
+        if (d == 0) {
+            out[i] = divide_by_zero(a[i]);
+            continue;
+        }
+        if (d != cached) {
+            recip_setup(&r, (d < 0) ? (uint32_t)(-(int32_t)d) : (uint32_t)d);
+            cached = d;
+        }
+        out[i] = divide_with(&r, a[i], d < 0, q);
+    }
+}
+
+void reciprocal_fixed_batch(const int16_t *x, int16_t q, int16_t *out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = reciprocal_fixed(x[i], q);
+    }
+}
+
+void sqrt_fixed_batch(const int16_t *x, int16_t q, int16_t *out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = sqrt_fixed(x[i], q);
+    }
+}
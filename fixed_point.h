@@ -2,10 +2,30 @@
 #define FIXED_POINT_H
 
 #include <stdint.h>
+#include <stddef.h>
+
+/* Buffer size that always fits one format_fixed result plus its NUL. */
+#define FIXED_FMT_MAX 80
+
+/* Buffer size that always fits one format_poly_line result plus its NUL. */
+#define FIXED_LINE_MAX (4 * FIXED_FMT_MAX + 64)
 
 /* Prints a fixed-point number (raw) in decimal, using q fractional bits. */
 void    print_fixed(int16_t raw, int16_t q);
 
+/*
+ * Renders raw as print_fixed would (integer part, '.', six digits) into
+ * buf, which must hold FIXED_FMT_MAX bytes. No stdio, no allocation.
+ * Returns the length written, excluding the terminating NUL.
+ */
+int     format_fixed(char *buf, int16_t raw, int16_t q);
+
+/*
+ * Renders the eval_poly_ax2_minus_bx_plus_c_fixed message for result y,
+ * newline included, into buf (FIXED_LINE_MAX bytes). Returns the length.
+ */
+int     format_poly_line(char *buf, int16_t a, int16_t b, int16_t c, int16_t y, int16_t q);
+
 /* Fixed-point addition (same q for both inputs). */
 int16_t add_fixed(int16_t a, int16_t b);
 
@@ -15,6 +35,25 @@ int16_t subtract_fixed(int16_t a, int16_t b);
 /* Fixed-point multiplication (a*b)>>q (same q for both inputs). */
 int16_t multiply_fixed(int16_t a, int16_t b, int16_t q);
 
+/* Largest q accepted by divide_fixed, reciprocal_fixed and sqrt_fixed (min 0).
+ * Any other q returns 0, which looks the same as a genuine zero result. */
+#define FIXED_DIV_MAX_Q 16
+
+/* Fixed-point division (a*2^q)/b, exact, truncated toward zero, saturated to
+ * int16. b == 0 saturates toward the sign of a (0 for 0/0). */
+int16_t divide_fixed(int16_t a, int16_t b, int16_t q);
+
+/* Fixed-point reciprocal 2^(2q)/x, exact, truncated toward zero, saturated
+ * to int16. x == 0 returns INT16_MAX. */
+int16_t reciprocal_fixed(int16_t x, int16_t q);
+
+/* Fixed-point square root floor(sqrt(x*2^q)), saturated to INT16_MAX.
+ * x <= 0 returns 0. */
+int16_t sqrt_fixed(int16_t x, int16_t q);
+
+/* Evaluate y = a*x^2 - b*x + c in fixed-point and return it (no printing). */
+int16_t poly_ax2_minus_bx_plus_c_fixed(int16_t x, int16_t a, int16_t b, int16_t c, int16_t q);
+
 /* Evaluate y = a*x^2 - b*x + c in fixed-point and print the required message. */
 void eval_poly_ax2_minus_bx_plus_c_fixed(int16_t x,
                                             int16_t a,
@@ -22,4 +61,63 @@ void eval_poly_ax2_minus_bx_plus_c_fixed(int16_t x,
                                             int16_t c,
                                             int16_t q);
 
+/*
+ * Batch API. Each call writes n int16 results to 'out' and matches the
+ * scalar functions above bit for bit. SIMD kernels (AVX2, SSE2 or NEON,
+ * chosen at compile time) handle q in [0,16]; other q and the tail of the
+ * arrays use the scalar path. 'out' may alias an input array.
+ */
+
+/* out[i] = multiply_fixed(a[i], b[i], q). */
+void multiply_fixed_batch(const int16_t *a, const int16_t *b, int16_t q,
+                          int16_t *out, size_t n);
+
+/* out[i] = a*x[i]^2 - b*x[i] + c, with one coefficient set for the batch. */
+void eval_poly_ax2_minus_bx_plus_c_batch(const int16_t *x,
+                                         int16_t a,
+                                         int16_t b,
+                                         int16_t c,
+                                         int16_t q,
+                                         int16_t *out,
+                                         size_t n);
+
+/* out[i] = a[i]*x[i]^2 - b[i]*x[i] + c[i], one coefficient set per element. */
+void eval_poly_ax2_minus_bx_plus_c_batch_tuples(const int16_t *x,
+                                                const int16_t *a,
+                                                const int16_t *b,
+                                                const int16_t *c,
+                                                int16_t q,
+                                                int16_t *out,
+                                                size_t n);
+
+/*
+ * Batch forms of divide_fixed, reciprocal_fixed and sqrt_fixed. Runs of
+ * equal divisors reuse the refined reciprocal instead of recomputing it.
+ */
+void divide_fixed_batch(const int16_t *a, const int16_t *b, int16_t q,
+                        int16_t *out, size_t n);
+void reciprocal_fixed_batch(const int16_t *x, int16_t q, int16_t *out, size_t n);
+void sqrt_fixed_batch(const int16_t *x, int16_t q, int16_t *out, size_t n);
+
+/*
+ * Q values with their own compile-time specialized Horner kernels:
+ * 4, 8, 10, 12, 14 and 15. Each must be in [0, 16].
+ */
+#define FIXED_HORNER_QS(X) X(4) X(8) X(10) X(12) X(14) X(15)
+
+/*
+ * General polynomial, Horner's scheme:
+ *   y = coeffs[0] + coeffs[1]*x + ... + coeffs[degree]*x^degree
+ * evaluated as (((coeffs[degree]*x + coeffs[degree-1])*x + ...)*x + coeffs[0],
+ * with multiply_fixed/add_fixed semantics at every step. This rounds
+ * differently from eval_poly_ax2_minus_bx_plus_c_fixed, which squares x
+ * first. q in FIXED_HORNER_QS (4, 8, 10, 12, 14, 15) runs a kernel compiled
+ * for that q; any other q uses the generic kernel. A negative degree yields 0.
+ */
+int16_t eval_poly_horner_fixed(const int16_t *coeffs, int degree, int16_t x, int16_t q);
+
+/* out[i] = eval_poly_horner_fixed(coeffs, degree, x[i], q). */
+void eval_poly_horner_fixed_batch(const int16_t *coeffs, int degree, const int16_t *x,
+                                  int16_t q, int16_t *out, size_t n);
+
 #endif // FIXED_POINT_H
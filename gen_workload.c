@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "workload.h"
+
+/*
+ * Synthetic workload generator for ex1 / ex2.
+ *
+ * Build: gcc -O2 gen_workload.c workload.c -o gen_workload
+ */
+
+static void print_usage(const char *prog) {
+    printf("Usage:\n");
+    printf("  %s corrupted <out.txt> <records> <density> <dup_ratio> [seed]\n", prog);
+    printf("  %s org <out.txt> <supports_per_hand> [seed]\n", prog);
+    printf("  %s cipher <org.txt> <out_cipher.txt> <mask> <XOR|AND>\n", prog);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 0;
+    }
+
+    int ok = 0;
+
+    if (strcmp(argv[1], "corrupted") == 0 && (argc == 6 || argc == 7)) {
+        unsigned seed = (argc == 7) ? (unsigned)strtoul(argv[6], NULL, 10) : 1;
+        ok = gen_corrupted_file(argv[2], atol(argv[3]), atof(argv[4]), atof(argv[5]), seed);
+    } else if (strcmp(argv[1], "org") == 0 && (argc == 4 || argc == 5)) {
+        unsigned seed = (argc == 5) ? (unsigned)strtoul(argv[4], NULL, 10) : 1;
+        ok = gen_org_file(argv[2], atol(argv[3]), seed);
+    } else if (strcmp(argv[1], "cipher") == 0 && argc == 6) {
+        int is_xor = (strcmp(argv[5], "XOR") == 0);
+        if (!is_xor && strcmp(argv[5], "AND") != 0) {
+            print_usage(argv[0]);
+            return 0;
+        }
+        ok = gen_cipher_file(argv[2], argv[3], atoi(argv[4]), is_xor);
+    } else {
+        print_usage(argv[0]);
+        return 0;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "org_search.h"
+
+// Functions
+int read_cipher_file(const char *path, int *cipher_vals);
+int check_candidate(Node *node, int *cipher_vals, int mask, int is_xor);
+Node* search_org(Org *org, int *cipher_vals, int mask, int is_xor);
+Node* search_masks(Org *org, int *cipher_vals, int start_mask, int *found_mask, int *found_xor);
+
+
+/*
+ * Parses the cipher file: FP_LEN lines of binary strings, one per
+ * encrypted byte, converted to integers.
+ *
+ * path:        Path to the cipher file.
+ * cipher_vals: Output array of FP_LEN integers.
+ *
+ * Returns: Number of lines parsed, or -1 if the file could not be opened.
+ */
+int read_cipher_file(const char *path, int *cipher_vals) {
+    FILE *cipher_fp = fopen(path, "r");
+    if (!cipher_fp) {
+        return -1;
+    }
+
+    char line[32];
+    int line_count = 0;
+
+    while (line_count < FP_LEN && fgets(line, sizeof(line), cipher_fp)) {
+        // Remove trailing newline
+        line[strcspn(line, "\r\n")] = 0;
+
+        // Convert binary string to integer (base 2)
+        cipher_vals[line_count] = (int)strtol(line, NULL, 2);
+        line_count++;
+    }
+    fclose(cipher_fp);
+
+    return line_count;
+}
+
+/*
+ * Verifies if a specific node's fingerprint matches the encrypted data
+ * given a specific mask and bitwise operation.
+ *
+ * node:        The organization node to check.
+ * cipher_vals: Array of 9 integer values representing the encrypted bytes.
+ * mask:        The 8-bit mask being tested (integer).
+ * is_xor:      Flag (1 for XOR operation, 0 for AND operation).
+ *
+ * Returns: 1 if the fingerprint matches the cipher, 0 otherwise.
+ */
+int check_candidate(Node *node, int *cipher_vals, int mask, int is_xor) {
+    if (!node) return 0;
+
+    // Iterate through all 9 characters of the fingerprint
+    for (int i = 0; i < FP_LEN; i++) {
+        char plain_char = node->fingerprint[i];
+        int computed_val;
+
+        // Apply the candidate mask using the candidate operation
+        if (is_xor) {
+            computed_val = plain_char ^ mask;
+        } else {
+            computed_val = plain_char & mask;
+        }
+
+        // Compare calculated value against the actual encrypted byte
+        if (computed_val != cipher_vals[i]) {
+            return 0;
+        }
+    }
+    
+    // If all 9 characters matched
+    return 1;
+}
+
+/*
+ * Traverses the entire organization tree to look for a matching fingerprint.
+ * The traversal order covers every node: Boss, Left Hand, Right Hand, 
+ * and their respective support lists.
+ *
+ * org:         Pointer to the Organization structure.
+ * cipher_vals: Array of encrypted bytes.
+ * mask:        The mask to test.
+ * is_xor:      Operation flag (1 for XOR, 0 for AND).
+ *
+ * Returns: Pointer to the matching Node if found, NULL otherwise.
+ */
+Node* search_org(Org *org, int *cipher_vals, int mask, int is_xor) {
+    if (!org) return NULL;
+
+    // Check the Boss (Root)
+    if (check_candidate(org->boss, cipher_vals, mask, is_xor)) 
+        return org->boss;
+
+    // Check the Left Hand
+    if (check_candidate(org->left_hand, cipher_vals, mask, is_xor)) 
+        return org->left_hand;
+
+    // Check Left Hand's Support List
+    if (org->left_hand) {
+        Node *curr = org->left_hand->supports_head;
+        while (curr) {
+            if (check_candidate(curr, cipher_vals, mask, is_xor)) return curr;
+            curr = curr->next;
+        }
+    }
+
+    // Check the Right Hand
+    if (check_candidate(org->right_hand, cipher_vals, mask, is_xor)) 
+        return org->right_hand;
+
+    // Check Right Hand's Support List
+    if (org->right_hand) {
+        Node *curr = org->right_hand->supports_head;
+        while (curr) {
+            if (check_candidate(curr, cipher_vals, mask, is_xor)) return curr;
+            curr = curr->next;
+        }
+    }
+
+    return NULL; // No match found in the entire organization
+}
+
+
+/*
+ * Tries every mask in the range [start_mask, start_mask + MASK_SPAN],
+ * testing XOR before AND for each mask.
+ *
+ * org:         Pointer to the Organization structure.
+ * cipher_vals: Array of encrypted bytes.
+ * start_mask:  First mask to test.
+ * found_mask:  Set to the matching mask on success.
+ * found_xor:   Set to 1 if the match used XOR, 0 for AND.
+ *
+ * Returns: Pointer to the matching Node if found, NULL otherwise.
+ */
+Node* search_masks(Org *org, int *cipher_vals, int start_mask, int *found_mask, int *found_xor) {
+    for (int m = start_mask; m <= start_mask + MASK_SPAN; m++) {
+
+        // Test XOR Operation
+        Node *match = search_org(org, cipher_vals, m, 1);
+        if (match) {
+            *found_mask = m;
+            *found_xor = 1;
+            return match;
+        }
+
+        // Test AND Operation
+        match = search_org(org, cipher_vals, m, 0);
+        if (match) {
+            *found_mask = m;
+            *found_xor = 0;
+            return match;
+        }
+    }
+
+    return NULL;
+}
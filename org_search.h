@@ -0,0 +1,20 @@
+#ifndef ORG_SEARCH_H
+#define ORG_SEARCH_H
+#include "org_tree.h"
+
+/*
+ * Constant: FP_LEN - The length of the fingerprint.
+ */
+#define FP_LEN 9
+
+/*
+ * Constant: MASK_SPAN - Masks in [s, s + MASK_SPAN] are tried.
+ */
+#define MASK_SPAN 10
+
+int read_cipher_file(const char *path, int *cipher_vals);
+int check_candidate(Node *node, int *cipher_vals, int mask, int is_xor);
+Node* search_org(Org *org, int *cipher_vals, int mask, int is_xor);
+Node* search_masks(Org *org, int *cipher_vals, int start_mask, int *found_mask, int *found_xor);
+
+#endif // ORG_SEARCH_H
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "workload.h"
+
+/*
+ * Struct: Rng
+ * Small xorshift generator so generated files are identical across
+ * platforms for the same seed (rand() is not).
+ */
+typedef struct {
+    uint64_t state;
+} Rng;
+
+// Functions
+static void rng_seed(Rng *rng, unsigned seed);
+static uint64_t rng_next(Rng *rng);
+static double rng_unit(Rng *rng);
+static void make_fingerprint(char *dest, long index, unsigned seed);
+static const char *position_for(long index);
+static void put_corrupted(FILE *out, const char *text, double density, Rng *rng);
+static void write_clean_record(FILE *out, long index, const char *position, unsigned seed);
+
+static const char *first_names[] = {
+    "Walter", "Jesse", "Saul", "Gustavo", "Mike", "Hank", "Skyler", "Lydia"
+};
+static const char *second_names[] = {
+    "White", "Pinkman", "Goodman", "Fring", "Ehrmantraut", "Schrader", "Lambert", "Quayle"
+};
+#define NAME_COUNT 8
+
+static const char corruption_chars[] = "#?!&$@";
+static const char fp_alphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static void rng_seed(Rng *rng, unsigned seed) {
+    // xorshift must never hold a zero state
+    rng->state = ((uint64_t)seed << 1) ^ 0x9E3779B97F4A7C15ULL;
+}
+
+static uint64_t rng_next(Rng *rng) {
+    uint64_t x = rng->state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rng->state = x;
+    return x;
+}
+
+/*
+ * Returns a uniform double in [0,1).
+ */
+static double rng_unit(Rng *rng) {
+    return (double)(rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+ * Builds a unique 9-character fingerprint for record 'index'.
+ * The index is scrambled with an odd multiplier coprime with 36, which is a
+ * bijection modulo 36^9, so distinct indices never collide.
+ */
+static void make_fingerprint(char *dest, long index, unsigned seed) {
+    const uint64_t space = 101559956668416ULL; // 36^9
+    uint64_t v = ((uint64_t)index * 2654435761ULL + seed) % space;
+
+    for (int i = WL_FP_LEN - 1; i >= 0; i--) {
+        dest[i] = fp_alphabet[v % 36];
+        v /= 36;
+    }
+    dest[WL_FP_LEN] = '\0';
+}
+
+/*
+ * Position of the record at 'index': Boss, both Hands, then supports
+ * alternating between the two Hands.
+ */
+static const char *position_for(long index) {
+    if (index == 0) return "Boss";
+    if (index == 1) return "Left Hand";
+    if (index == 2) return "Right Hand";
+    return (index % 2) ? "Support_Left" : "Support_Right";
+}
+
+/*
+ * Writes 'text', inserting a random corruption character after each
+ * character with probability 'density'.
+ */
+static void put_corrupted(FILE *out, const char *text, double density, Rng *rng) {
+    for (const char *p = text; *p; p++) {
+        fputc(*p, out);
+        if (density > 0.0 && rng_unit(rng) < density) {
+            fputc(corruption_chars[rng_next(rng) % (sizeof(corruption_chars) - 1)], out);
+        }
+    }
+}
+
+static void write_clean_record(FILE *out, long index, const char *position, unsigned seed) {
+    char fp[WL_FP_LEN + 1];
+    make_fingerprint(fp, index, seed);
+
+    fprintf(out, "First Name: %s\nSecond Name: %s\nFingerprint: %s\nPosition: %s\n\n",
+            first_names[index % NAME_COUNT], second_names[(index / NAME_COUNT) % NAME_COUNT],
+            fp, position);
+}
+
+int gen_corrupted_file(const char *path, long records, double density,
+                       double dup_ratio, unsigned seed) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        printf("Error opening file: %s\n", path);
+        return 0;
+    }
+
+    Rng rng;
+    rng_seed(&rng, seed);
+
+    char fp[WL_FP_LEN + 1];
+    char record[4 * 128];
+
+    for (long i = 0; i < records; i++) {
+        // The first three records form the tree and are never duplicates
+        long fp_index = i;
+        if (i >= 3 && rng_unit(&rng) < dup_ratio) {
+            fp_index = (long)(rng_next(&rng) % (uint64_t)i);
+        }
+        make_fingerprint(fp, fp_index, seed);
+
+        snprintf(record, sizeof(record),
+                 "First Name: %s\nSecond Name: %s\nFingerprint: %s\nPosition: %s\n\n",
+                 first_names[i % NAME_COUNT], second_names[(i / NAME_COUNT) % NAME_COUNT],
+                 fp, position_for(i));
+        put_corrupted(out, record, density, &rng);
+    }
+
+    fclose(out);
+    return 1;
+}
+
+int gen_org_file(const char *path, long supports, unsigned seed) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        printf("Error opening file: %s\n", path);
+        return 0;
+    }
+
+    long total = 3 + 2 * supports;
+    for (long i = 0; i < total; i++) {
+        write_clean_record(out, i, position_for(i), seed);
+    }
+
+    fclose(out);
+    return 1;
+}
+
+int gen_cipher_file(const char *org_path, const char *path, int mask, int is_xor) {
+    FILE *in = fopen(org_path, "r");
+    if (!in) {
+        printf("Error opening file: %s\n", org_path);
+        return 0;
+    }
+
+    // Keep the last fingerprint in the file
+    char line[128];
+    char fp[WL_FP_LEN + 1] = {0};
+    const char *label = "Fingerprint: ";
+    while (fgets(line, sizeof(line), in)) {
+        if (strstr(line, label) == line) {
+            strncpy(fp, line + strlen(label), WL_FP_LEN);
+            fp[WL_FP_LEN] = '\0';
+        }
+    }
+    fclose(in);
+
+    if (strlen(fp) != WL_FP_LEN) {
+        printf("No fingerprint found in: %s\n", org_path);
+        return 0;
+    }
+
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        printf("Error opening file: %s\n", path);
+        return 0;
+    }
+
+    for (int i = 0; i < WL_FP_LEN; i++) {
+        int val = is_xor ? (fp[i] ^ mask) : (fp[i] & mask);
+
+        // At least 8 bits, more if the mask pushed the value past a byte
+        int bits = 8;
+        while (bits < 31 && (val >> bits) != 0) bits++;
+        for (int b = bits - 1; b >= 0; b--) {
+            fputc((val >> b) & 1 ? '1' : '0', out);
+        }
+        fputc('\n', out);
+    }
+
+    fclose(out);
+    return 1;
+}
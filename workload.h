@@ -0,0 +1,39 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+/* Length of generated fingerprints (ex2 compares this many characters). */
+#define WL_FP_LEN 9
+
+/*
+ * Writes a corrupted record file in the ex1 input format.
+ *
+ * records:   Total number of records to emit (Boss and both Hands included).
+ * density:   Probability in [0,1] of inserting a corruption character
+ *            (# ? ! & $ @) after every emitted character.
+ * dup_ratio: Probability in [0,1] that a record reuses an earlier fingerprint.
+ * seed:      Seed for the generator, so runs are reproducible.
+ *
+ * Returns: 1 on success, 0 if the file could not be written.
+ */
+int gen_corrupted_file(const char *path, long records, double density,
+                       double dup_ratio, unsigned seed);
+
+/*
+ * Writes a clean org file (the format ex1 produces and ex2 reads) holding
+ * a Boss, both Hands and 'supports' supports under each Hand.
+ *
+ * Returns: 1 on success, 0 if the file could not be written.
+ */
+int gen_org_file(const char *path, long supports, unsigned seed);
+
+/*
+ * Writes a cipher file for ex2 that encrypts the last fingerprint found in
+ * 'org_path' (the worst case for the search) with 'mask' using XOR
+ * (is_xor = 1) or AND (is_xor = 0). One binary string per line, 8 bits
+ * wide, or wider when a large mask pushes the value past a byte.
+ *
+ * Returns: 1 on success, 0 on a missing/invalid org file or write error.
+ */
+int gen_cipher_file(const char *org_path, const char *path, int mask, int is_xor);
+
+#endif // WORKLOAD_H